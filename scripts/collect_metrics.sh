@@ -245,55 +245,91 @@ if [[ -n "$opt_line" ]]; then
 fi
 
 # web_server.cpp
+# Helper: print the lines of the block that starts at the first line
+# containing <header>, up to the next blank line
+section_lines() {
+  local out="$1" header="$2"
+  awk -v h="$header" 'index($0, h) { inside = 1; next } inside && /^[[:space:]]*$/ { exit } inside' "$out"
+}
+# Helper: numeric value of "<label>: <number>..." inside that block
+section_value() {
+  local out="$1" header="$2" label="$3"
+  awk -v h="$header" -v l="$label:" '
+    index($0, h) { inside = 1; next }
+    inside && /^[[:space:]]*$/ { exit }
+    inside && index($0, l) { v = substr($0, index($0, l) + length(l)); sub(/^ */, "", v)
+                             if (match(v, /^[0-9.e+-]+/)) print substr(v, 1, RLENGTH); exit }' "$out"
+}
+# Helper: emit p50/p90/p99/p99.9/max rows from the "Latency ..." and
+# "Route ..." lines of the block that starts at <header>
+record_latency_percentiles() {
+  local out="$1" header="$2" prefix="$3"
+  local label value
+  for label in p50 p90 p99 p99.9 max; do
+    value=$(section_value "$out" "$header" "Latency $label")
+    [[ -n "$value" ]] && printf "Uygulamalar,web_server.cpp,web_server,%s_latency_%s,%s,microseconds\n" "$prefix" "$label" "$value" >> "$CSV"
+  done
+  # Per-route lines: "Route <path> p50/p90/p99/p99.9/max: a/b/c/d/eus"
+  local line route values i
+  while IFS= read -r line; do
+    [[ "$line" =~ ^\ +Route\ (.+)\ p50/p90/p99/p99\.9/max:\ ([0-9./e+-]+)us$ ]] || continue
+    route=$(echo "${BASH_REMATCH[1]}" | sed -E 's#^/$#root#; s#[()]##g; s#^/##; s#/#_#g')
+    IFS=/ read -r -a values <<< "${BASH_REMATCH[2]}"
+    i=0
+    for label in p50 p90 p99 p99.9 max; do
+      printf "Uygulamalar,web_server.cpp,web_server,%s_route_%s_latency_%s,%s,microseconds\n" "$prefix" "$route" "$label" "${values[$i]}" >> "$CSV"
+      i=$((i+1))
+    done
+  done < <(section_lines "$out" "$header")
+}
+# Helper: the rows print_stats() reports for one server variant
+record_server_stats() {
+  local out="$1" header="$2" prefix="$3" total_time="$4"
+  local rqs alloc avgus hit
+  rqs=$(section_value "$out" "$header" "Requests")
+  alloc=$(section_value "$out" "$header" "Allocations")
+  avgus=$(section_value "$out" "$header" "Avg response time")
+  hit=$(section_value "$out" "$header" "Cache hit ratio")
+  [[ -n "$total_time" ]] && printf "Uygulamalar,web_server.cpp,web_server,%s_total_time,%s,ms\n" "$prefix" "$total_time" >> "$CSV"
+  [[ -n "$rqs" ]] && printf "Uygulamalar,web_server.cpp,web_server,%s_requests,%s,count\n" "$prefix" "$rqs" >> "$CSV"
+  [[ -n "$alloc" ]] && printf "Uygulamalar,web_server.cpp,web_server,%s_allocations,%s,count\n" "$prefix" "$alloc" >> "$CSV"
+  [[ -n "$avgus" ]] && printf "Uygulamalar,web_server.cpp,web_server,%s_avg_us,%s,microseconds\n" "$prefix" "$avgus" >> "$CSV"
+  record_latency_percentiles "$out" "$header" "$prefix"
+  [[ -n "$hit" ]] && printf "Uygulamalar,web_server.cpp,web_server,%s_cache_hit_rate,%s,percent\n" "$prefix" "$hit" >> "$CSV"
+  return 0
+}
+
 echo "Building and running web_server.cpp..."
 SRC10="$ROOT_DIR/04_Uygulamalar/src/web_server.cpp"
 WEB_DIR="$OUT_DIR/web_server"
 mkdir -p "$WEB_DIR"
 BIN10="$WEB_DIR/web_server"
-clang++ -std=c++11 -O2 -pthread -o "$BIN10" "$SRC10"
+clang++ -std=c++20 -O2 -pthread -o "$BIN10" "$SRC10"
 RUN10_OUT="$WEB_DIR/web_server.out"
 "$BIN10" > "$RUN10_OUT" 2>&1 || true
-# Inefficient test
-inf_time=$(grep -E "Total test time:\s+[0-9]+ms" "$RUN10_OUT" | head -n1 | sed -E 's/.*: ([0-9]+)ms/\1/')
-inf_req=$(grep -n "Inefficient Web Server Performance Stats:" "$RUN10_OUT" | head -n1 | cut -d: -f1)
-if [[ -n "$inf_req" ]]; then
-  l=$((inf_req+1)); rqs=$(sed -n "${l}p" "$RUN10_OUT" | sed -E 's/.*: ([0-9]+)/\1/')
-  l=$((inf_req+2)); alloc=$(sed -n "${l}p" "$RUN10_OUT" | sed -E 's/.*: ([0-9]+)/\1/')
-  l=$((inf_req+3)); avgms=$(sed -n "${l}p" "$RUN10_OUT" | sed -E 's/.*: ([0-9]+)ms/\1/')
-  l=$((inf_req+4)); hit=$(sed -n "${l}p" "$RUN10_OUT" | sed -E 's/.*: ([0-9.]+)%/\1/')
-  [[ -n "$inf_time" ]] && printf "Uygulamalar,web_server.cpp,web_server,inefficient_total_time,%s,ms\n" "$inf_time" >> "$CSV"
-  [[ -n "$rqs" ]] && printf "Uygulamalar,web_server.cpp,web_server,inefficient_requests,%s,count\n" "$rqs" >> "$CSV"
-  [[ -n "$alloc" ]] && printf "Uygulamalar,web_server.cpp,web_server,inefficient_allocations,%s,count\n" "$alloc" >> "$CSV"
-  [[ -n "$avgms" ]] && printf "Uygulamalar,web_server.cpp,web_server,inefficient_avg_ms,%s,ms\n" "$avgms" >> "$CSV"
-  [[ -n "$hit" ]] && printf "Uygulamalar,web_server.cpp,web_server,inefficient_cache_hit_rate,%s,percent\n" "$hit" >> "$CSV"
-fi
-# Optimized test
-opt_time=$(grep -E "Total test time:\s+[0-9]+ms" "$RUN10_OUT" | sed -n '2p' | sed -E 's/.*: ([0-9]+)ms/\1/')
-opt_req=$(grep -n "Optimized Web Server Performance Stats:" "$RUN10_OUT" | head -n1 | cut -d: -f1)
-if [[ -n "$opt_req" ]]; then
-  l=$((opt_req+1)); rqs=$(sed -n "${l}p" "$RUN10_OUT" | sed -E 's/.*: ([0-9]+)/\1/')
-  l=$((opt_req+2)); alloc=$(sed -n "${l}p" "$RUN10_OUT" | sed -E 's/.*: ([0-9]+)/\1/')
-  l=$((opt_req+3)); avgms=$(sed -n "${l}p" "$RUN10_OUT" | sed -E 's/.*: ([0-9]+)ms/\1/')
-  l=$((opt_req+4)); hit=$(sed -n "${l}p" "$RUN10_OUT" | sed -E 's/.*: ([0-9.]+)%/\1/')
-  [[ -n "$opt_time" ]] && printf "Uygulamalar,web_server.cpp,web_server,optimized_total_time,%s,ms\n" "$opt_time" >> "$CSV"
-  [[ -n "$rqs" ]] && printf "Uygulamalar,web_server.cpp,web_server,optimized_requests,%s,count\n" "$rqs" >> "$CSV"
-  [[ -n "$alloc" ]] && printf "Uygulamalar,web_server.cpp,web_server,optimized_allocations,%s,count\n" "$alloc" >> "$CSV"
-  [[ -n "$avgms" ]] && printf "Uygulamalar,web_server.cpp,web_server,optimized_avg_ms,%s,ms\n" "$avgms" >> "$CSV"
-  [[ -n "$hit" ]] && printf "Uygulamalar,web_server.cpp,web_server,optimized_cache_hit_rate,%s,percent\n" "$hit" >> "$CSV"
-fi
-# Pooled concurrent test
-pool_time=$(grep -E "Concurrent test completed in:\s+[0-9]+ms" "$RUN10_OUT" | sed -E 's/.*: ([0-9]+)ms/\1/' | tail -n1)
-pool_req=$(grep -n "Connection Pooled Server Performance Stats:" "$RUN10_OUT" | head -n1 | cut -d: -f1)
-if [[ -n "$pool_req" ]]; then
-  l=$((pool_req+1)); rqs=$(sed -n "${l}p" "$RUN10_OUT" | sed -E 's/.*: ([0-9]+)/\1/')
-  l=$((pool_req+2)); alloc=$(sed -n "${l}p" "$RUN10_OUT" | sed -E 's/.*: ([0-9]+)/\1/')
-  l=$((pool_req+3)); avgms=$(sed -n "${l}p" "$RUN10_OUT" | sed -E 's/.*: ([0-9]+)ms/\1/')
-  l=$((pool_req+4)); hit=$(sed -n "${l}p" "$RUN10_OUT" | sed -E 's/.*: ([0-9.]+)%/\1/')
-  [[ -n "$pool_time" ]] && printf "Uygulamalar,web_server.cpp,web_server,pooled_total_time,%s,ms\n" "$pool_time" >> "$CSV"
-  [[ -n "$rqs" ]] && printf "Uygulamalar,web_server.cpp,web_server,pooled_requests,%s,count\n" "$rqs" >> "$CSV"
-  [[ -n "$alloc" ]] && printf "Uygulamalar,web_server.cpp,web_server,pooled_allocations,%s,count\n" "$alloc" >> "$CSV"
-  [[ -n "$avgms" ]] && printf "Uygulamalar,web_server.cpp,web_server,pooled_avg_ms,%s,ms\n" "$avgms" >> "$CSV"
-  [[ -n "$hit" ]] && printf "Uygulamalar,web_server.cpp,web_server,pooled_cache_hit_rate,%s,percent\n" "$hit" >> "$CSV"
+inf_time=$(section_value "$RUN10_OUT" "Running inefficient web server load test" "Total test time")
+record_server_stats "$RUN10_OUT" "Inefficient Web Server Performance Stats:" "inefficient" "$inf_time"
+opt_time=$(section_value "$RUN10_OUT" "Running optimized web server load test" "Total test time")
+record_server_stats "$RUN10_OUT" "Optimized Web Server Performance Stats:" "optimized" "$opt_time"
+pool_time=$(section_value "$RUN10_OUT" "concurrent requests with" "Concurrent test completed in")
+record_server_stats "$RUN10_OUT" "Connection Pooled Server Performance Stats:" "pooled" "$pool_time"
+# Route lookup microbenchmark (part of the default run)
+route_map_ns=$(grep -E "unordered_map<std::string> lookup:" "$RUN10_OUT" | sed -E 's/.*: ([0-9.]+) ns/\1/' | tail -n1)
+route_phf_ns=$(grep -E "Perfect hash lookup:" "$RUN10_OUT" | sed -E 's/.*: ([0-9.]+) ns/\1/' | tail -n1)
+[[ -n "$route_map_ns" ]] && printf "Uygulamalar,web_server.cpp,web_server,route_lookup_map,%s,ns\n" "$route_map_ns" >> "$CSV"
+[[ -n "$route_phf_ns" ]] && printf "Uygulamalar,web_server.cpp,web_server,route_lookup_perfect_hash,%s,ns\n" "$route_phf_ns" >> "$CSV"
+# Real socket path (Linux only): epoll server + loopback client
+if [[ "$(uname -s)" == "Linux" ]]; then
+  RUN10E_OUT="$WEB_DIR/web_server_epoll.out"
+  "$BIN10" --epoll-bench 10000 > "$RUN10E_OUT" 2>&1 || true
+  EPOLL_STATS="epoll Loopback Server Stats:"
+  epoll_rps=$(section_value "$RUN10E_OUT" "$EPOLL_STATS" "Throughput")
+  epoll_sys=$(section_value "$RUN10E_OUT" "$EPOLL_STATS" "Server syscalls/request")
+  epoll_kus=$(section_value "$RUN10E_OUT" "$EPOLL_STATS" "Server sys time/request")
+  [[ -n "$epoll_rps" ]] && printf "Uygulamalar,web_server.cpp,web_server,epoll_requests_per_sec,%s,count\n" "$epoll_rps" >> "$CSV"
+  [[ -n "$epoll_sys" ]] && printf "Uygulamalar,web_server.cpp,web_server,epoll_syscalls_per_request,%s,count\n" "$epoll_sys" >> "$CSV"
+  [[ -n "$epoll_kus" ]] && printf "Uygulamalar,web_server.cpp,web_server,epoll_sys_time_per_request,%s,microseconds\n" "$epoll_kus" >> "$CSV"
+  record_latency_percentiles "$RUN10E_OUT" "$EPOLL_STATS" "epoll"
 fi
 
 # Emit Markdown summary